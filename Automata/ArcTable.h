@@ -0,0 +1,91 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file ArcTable.h
+ * Store the arcs of an automaton state by state in contiguous spans
+ */
+
+#ifndef ARCTABLE_H_
+#define ARCTABLE_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <vector>
+#include "TransRel.h"
+
+class ArcTable {
+ public:
+  /**The arcs of a state, from the first to one past the last*/
+  typedef std::pair<const class GuardArc *, const class GuardArc *> Span;
+  /**Constructor of the class
+   *@param size Number of states
+   */
+  explicit ArcTable(unsigned size=0);
+  /**The destructor*/
+  ~ArcTable();
+ private:
+  /**Copy constructor*/
+  ArcTable(const class ArcTable &old);
+  /**Assignment operator*/
+  class ArcTable & operator=(const class ArcTable &rhs);
+ public:
+  /**Extend the table 
+   * @param size The new number of states
+   */
+  void grow(unsigned size);
+  /**@return true iff no arcs have been stored*/
+  bool empty() const {return myBlocks.empty();}
+  /**@return true iff the arcs of a state have been stored*/
+  bool isStored(unsigned state) const {
+    assert(state<mySize);
+    return myRows[state].stored;
+  }
+  /**@return the arcs of a state*/
+  Span arcs(unsigned state) const {
+    assert(isStored(state));
+    return Span(myRows[state].first, myRows[state].first + myRows[state].count);
+  }
+  /**Move the arcs of a state from a staging relation to the table.
+   * The spans of the other states stay valid.
+   * @param state The source state
+   * @param staged The relation holding the arcs
+   */
+  void store(unsigned state, TransRel &staged);
+  /**Move all arcs from a staging relation to the table, in one block. 
+   * Every state is then stored, also the ones without arcs.
+   * @param staged The relation holding the arcs
+   */
+  void storeAll(TransRel &staged);
+  /**Move the arcs of a state back to a staging relation, so that they
+   * can be modified. The space of the arcs is not reused.
+   * @param state The source state
+   * @param staged (output) The relation receiving the arcs
+   */
+  void release(unsigned state, TransRel &staged);
+ private:
+  /**Reserve contiguous space for arcs
+   * @param count The number of arcs
+   * @return uninitialised space for count arcs
+   */
+  class GuardArc *allocate(unsigned count);
+  /**The span of a state*/
+  struct Row {
+    /**The first arc*/
+    class GuardArc *first;
+    /**The number of arcs*/
+    unsigned count;
+    /**Flag: have the arcs been stored*/
+    bool stored;
+  };
+  /**The rows of the states*/
+  struct Row *myRows;
+  /**The number of states*/
+  unsigned mySize;
+  /**The blocks of arcs and the number of arcs constructed in each*/
+  std::vector<std::pair<class GuardArc *, unsigned> > myBlocks;
+  /**The capacity of the last block*/
+  unsigned myCapacity;
+};
+
+#endif //ARCTABLE_H_
@@ -14,6 +14,8 @@
 struct _IO_FILE;
 typedef struct _IO_FILE FILE;
 #include <cstdio>
+#include <climits>
+#include "MultiMap.h"
 
 class Automaton {
   
@@ -28,8 +30,24 @@ class Automaton {
   virtual ~Automaton(); 
   /**@return The number of states in the automaton*/
   unsigned size() const {return mySize;}
-  /**@return The size of the alphabet*/
+  /**@return The size of the alphabet, or 0 if the letters cannot be 
+   * enumerated
+   */
   unsigned alphabetSize() const {return myAlphabetSize;}  
+  /**The largest number of atomic propositions whose letters fit in a label*/
+  static const unsigned maxLetterBits=CHAR_BIT * sizeof(unsigned) - 1;
+  /**@return The number of letters over some atomic propositions, or 0 if
+   * there are too many of them to number the letters
+   */
+  static unsigned letters(unsigned numAP) {
+    return (numAP <= maxLetterBits) ? 1u << numAP : 0;
+  }
+  /**@return The number of atomic propositions of an alphabet*/
+  static unsigned atoms(unsigned letters) {
+    unsigned numAP=0;
+    while((1u << numAP) < letters) numAP++;
+    return numAP;
+  }
    /**Get a successor state
    *@param source The source state
    *@param label The Label of the transition
@@ -43,6 +61,20 @@ class Automaton {
    * @return the number of outgoing arcs from state with label
    */
   virtual unsigned numArcs(unsigned state, unsigned label) const=0;
+  /**Collect the arcs leaving a state
+   * @param state
+   * @param arcs (output) map from destination state to label
+   */
+  virtual void collectArcs(unsigned state, MultiMap &arcs) const;
+  /**Collect the arcs leaving a state without expanding them into letters
+   * @param state
+   * @param arcs (output) map from destination state to guard
+   */
+  virtual void collectGuards(unsigned state, GuardMap &arcs) const;
+  /**Compute the arcs of all states, so that several threads may
+   * collect the arcs at the same time afterwards
+   */
+  virtual void computeArcs() const {;}
 
   /**Add a transition 
    *@param source The source state
@@ -0,0 +1,158 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Bdd.h
+ * A small package of reduced ordered binary decision diagrams
+ */
+
+#ifndef BDD_H_
+#define BDD_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <vector>
+
+/**A set of reduced ordered binary decision diagrams over a fixed number
+ * of variables. Variable 0 is tested first. The nodes are hash-consed, 
+ * so that two functions are equal iff their nodes are. Nodes are never
+ * freed before the package itself is destroyed.
+ */
+class Bdd {
+ public:
+  /**A node, identifying the function it represents*/
+  typedef unsigned Node;
+  /**The constant functions*/
+  enum {False=0, True=1};
+  /**Constructor of the class
+   *@param numVars The number of variables
+   */
+  explicit Bdd(unsigned numVars);
+  /**The destructor*/
+  ~Bdd();
+ private:
+  /**Copy constructor*/
+  Bdd(const class Bdd &old);
+  /**Assignment operator*/
+  class Bdd & operator=(const class Bdd &rhs);
+ public:
+  /**@return The number of variables*/
+  unsigned numVars() const {return myNumVars;}
+  /**@return The number of nodes, including the constants*/
+  unsigned size() const {return myNodes.size();}
+  /**@return The function that holds iff a variable does*/
+  Node var(unsigned v) {
+    assert(v<myNumVars);
+    return make(v, False, True);
+  }
+  /**@return if f then g else h*/
+  Node ite(Node f, Node g, Node h);
+  /**@return The negation of f*/
+  Node neg(Node f) {return ite(f, False, True);}
+  /**@return The conjunction of f and g*/
+  Node conj(Node f, Node g) {return ite(f, g, False);}
+  /**@return The disjunction of f and g*/
+  Node disj(Node f, Node g) {return ite(f, True, g);}
+  /**@return f if and only if g*/
+  Node equiv(Node f, Node g) {return ite(f, g, neg(g));}
+  /**Quantify variables existentially
+   *@param f The function
+   *@param cube The conjunction of the (positive) variables to quantify
+   *@return The function with the variables quantified
+   */
+  Node exists(Node f, Node cube);
+  /**Compute the existential quantification of a conjunction without
+   * constructing the conjunction itself
+   *@param f The first conjunct
+   *@param g The second conjunct
+   *@param cube The conjunction of the (positive) variables to quantify
+   *@return The function with the variables quantified
+   */
+  Node andExists(Node f, Node g, Node cube);
+  /**Fix the values of some variables
+   *@param f The function
+   *@param cube A conjunction of literals, one for each fixed variable
+   *@return The function with the variables replaced by their values
+   */
+  Node cofactor(Node f, Node cube);
+  /**Substitute functions for all variables at once
+   *@param f The function
+   *@param functions The function substituted for each variable
+   *@return The function after the substitution
+   */
+  Node compose(Node f, const Node *functions);
+  /**Rename variables
+   *@param f The function
+   *@param map The new number of each variable. The map must preserve 
+   * the order of the variables f depends on.
+   *@return The function after renaming
+   */
+  Node rename(Node f, const unsigned *map);
+  /**Evaluate a function
+   *@param f The function
+   *@param values The value of each variable
+   *@return The value of the function
+   */
+  bool eval(Node f, const bool *values) const;
+ private:
+  /**A decision node*/
+  struct Entry {
+    /**The variable tested, or myNumVars for the constants*/
+    unsigned var;
+    /**The function if the variable is false*/
+    Node low;
+    /**The function if the variable is true*/
+    Node high;
+  };
+  /**A cached result of an operation*/
+  struct Computed {
+    /**The operation, or opNone for an empty slot*/
+    unsigned op;
+    /**The operands*/
+    Node f, g, h;
+    /**The result*/
+    Node result;
+  };
+  /**The cached operations*/
+  enum {opNone, opIte, opExists, opAndExists, opCofactor};
+
+  /**@return The unique node testing v with the given cofactors*/
+  Node make(unsigned v, Node low, Node high);
+  /**@return The variable tested by a node*/
+  unsigned top(Node f) const {return myNodes[f].var;}
+  /**@return f with v false, when v is not below the top variable of f*/
+  Node low(Node f, unsigned v) const {
+    return myNodes[f].var==v ? myNodes[f].low : f;
+  }
+  /**@return f with v true, when v is not below the top variable of f*/
+  Node high(Node f, unsigned v) const {
+    return myNodes[f].var==v ? myNodes[f].high : f;
+  }
+  /**@return The cache slot of an operation*/
+  struct Computed &slot(unsigned op, Node f, Node g, Node h);
+  /**Double the size of the unique table*/
+  void rehash();
+  /**Substitute recursively, memorising the results in myMemo*/
+  Node compose(Node f);
+  /**Rename recursively, memorising the results in myMemo*/
+  Node rename(Node f);
+
+  /**The number of variables*/
+  unsigned myNumVars;
+  /**The nodes*/
+  std::vector<struct Entry> myNodes;
+  /**The unique table, an open addressing hash table of nodes*/
+  std::vector<Node> myUnique;
+  /**The computed table, a cache indexed by the hash of the operation*/
+  std::vector<struct Computed> myCache;
+  /**The results of the current compose or rename, by node*/
+  std::vector<Node> myMemo;
+  /**The operation for which each result in myMemo is valid*/
+  std::vector<unsigned> myStamps;
+  /**The current stamp*/
+  unsigned myStamp;
+  /**The argument of the current compose or rename*/
+  const unsigned *myArgument;
+};
+
+#endif //BDD_H_
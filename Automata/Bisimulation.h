@@ -0,0 +1,58 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Bisimulation.h
+ * Bisimulation equivalence of a nondeterministic automaton
+ */
+
+#ifndef BISIMULATION_H_
+#define BISIMULATION_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <vector>
+
+class NonDetAut;
+
+/**The coarsest bisimulation of a nondeterministic finite automaton.
+ * Bisimilar states are in the same final set and, for every letter,
+ * have arcs to the same classes.
+ *
+ * The guards are first split into a common partition of the letters,
+ * the parts, so that each guard is a union of parts. The classes are then
+ * refined by splitters over the inverse transitions by the parts, keeping
+ * all but the largest block of each split out of the work (Paige and
+ * Tarjan). With n states and m transitions by parts this takes
+ * O(m log n) time.
+ */
+class Bisimulation {
+ public:
+  /**Constructor of the class: compute the classes
+   *@param aut The automaton
+   *@param budget the limits of the computation, or 0. If a limit is 
+   * exceeded, the classes are left too coarse and must not be used.
+   */
+  explicit Bisimulation(const class NonDetAut &aut, class Budget *budget=0);
+  /**The destructor*/
+  ~Bisimulation() {;}
+ private:
+  /**Copy constructor*/
+  Bisimulation(const class Bisimulation &old);
+  /**Assignment operator*/
+  class Bisimulation & operator=(const class Bisimulation &rhs);
+ public:
+  /**@return the number of classes*/
+  unsigned size() const {return myNumClasses;}
+  /**@return the classes of the states, numbered in the order of
+   * their smallest states
+   */
+  const unsigned *classes() const {return &myClasses[0];}
+ private:
+  /**The class of each state*/
+  std::vector<unsigned> myClasses;
+  /**The number of classes*/
+  unsigned myNumClasses;
+};
+
+#endif //BISIMULATION_H_
@@ -22,7 +22,9 @@ class BitVector
 {
 public:
   /** machine word */
-  typedef unsigned word_t;
+  typedef unsigned long word_t;
+  /** number of bits in a word */
+  static const unsigned wordBits = CHAR_BIT * sizeof (word_t);
 
   /** Constructor
    * @param size	number of elements in the vector
@@ -71,7 +73,7 @@ public:
     mySize = size;
     const unsigned init = getNumWords (size);
     if (const unsigned rest = size % (CHAR_BIT * sizeof (word_t)))
-      assert (init >= 1), myBits[init - 1] &= (1u << rest) - 1;
+      assert (init >= 1), myBits[init - 1] &= (word_t (1) << rest) - 1;
     memset (myBits, 0, (myAllocated - init) * sizeof *myBits);
   }
   /** Set the size of the vector 
@@ -83,6 +85,11 @@ public:
    */
   unsigned getSize () const { return mySize; }
 
+  /** @return the words of the vector */
+  const word_t* getWords () const { return myBits; }
+  /** @return the words of the vector */
+  word_t* getWords () { return myBits; }
+
   /** Read a binary digit
    * @param index	zero-based index of the element
    * @return		value of the ternary digit
@@ -90,7 +97,7 @@ public:
   bool operator[] (unsigned index) const {
     assert (index < mySize);
     return myBits[index / (CHAR_BIT * sizeof (word_t))] &
-      (1u << (index % (CHAR_BIT * sizeof (word_t))));
+      (word_t (1) << (index % (CHAR_BIT * sizeof (word_t))));
   }
 
   /**Equality comparison*/
@@ -109,7 +116,7 @@ public:
   void assign (unsigned index, bool value) {
     assert (index < mySize);
     word_t& word = myBits[index / (CHAR_BIT * sizeof (word_t))];
-    word_t bit = 1u << (index % (CHAR_BIT * sizeof (word_t)));
+    word_t bit = word_t (1) << (index % (CHAR_BIT * sizeof (word_t)));
     if (value)
       word |= bit;
     else
@@ -123,7 +130,7 @@ public:
   bool tset (unsigned index) {
     assert (index < mySize);
     word_t& word = myBits[index / (CHAR_BIT * sizeof (word_t))];
-    word_t bit = 1u << (index % (CHAR_BIT * sizeof (word_t)));
+    word_t bit = word_t (1) << (index % (CHAR_BIT * sizeof (word_t)));
     if (word & bit)
       return true;
     word |= bit;
@@ -137,7 +144,7 @@ public:
   bool treset (unsigned index) {
     assert (index < mySize);
     word_t& word = myBits[index / (CHAR_BIT * sizeof (word_t))];
-    word_t bit = 1u << (index % (CHAR_BIT * sizeof (word_t)));
+    word_t bit = word_t (1) << (index % (CHAR_BIT * sizeof (word_t)));
     if (!(word & bit))
       return false;
     word &= ~bit;
@@ -157,7 +164,7 @@ public:
   bool allClear () const {
     unsigned i = mySize / (CHAR_BIT * sizeof (word_t));
     if (mySize && (myBits[i] &
-		   ((1u << (mySize % (CHAR_BIT * sizeof (word_t)))) - 1)))
+		   ((word_t (1) << (mySize % (CHAR_BIT * sizeof (word_t)))) - 1)))
       return false;
     while (i--) if (myBits[i]) return false;
     return true;
@@ -167,7 +174,7 @@ public:
   bool allSet () const {
     unsigned i = mySize / (CHAR_BIT * sizeof (word_t));
     if (mySize && ~(myBits[i] |
-		    ~((1u << (mySize % (CHAR_BIT * sizeof (word_t)))) - 1)))
+		    ~((word_t (1) << (mySize % (CHAR_BIT * sizeof (word_t)))) - 1)))
       return false;
     while (i--) if (~myBits[i]) return false;
     return true;
@@ -214,18 +221,53 @@ public:
 
   /**@return hashvalue of the contents*/
   int hash(int seed=0x9e3779b9) const {
-    for(unsigned i = getNumWords (mySize); i--; )
-      seed ^= myBits[i];
-    return seed;
+    word_t h = word_t (unsigned (seed));
+    for (unsigned i = getNumWords (mySize); i--; )
+      h = mix (h, myBits[i]);
+    return int (fold (h));
   }
   
   /**@return Number of true bits in the vector*/
   unsigned numTrue() const {
     unsigned count=0;
     for(unsigned i = getNumWords (mySize); i--; )
-      if((*this)[i])
-	count++;
+      count += popcount (myBits[i]);
+    return count;
+  }
+
+  /** Count the one bits of a word
+   * @param word	the word
+   * @return		the number of one bits in the word
+   */
+  static unsigned popcount (word_t word) {
+#ifdef __GNUC__
+    return __builtin_popcountl (word);
+#else
+    unsigned count = 0;
+    for (; word; word &= word - 1)
+      count++;
     return count;
+#endif // __GNUC__
+  }
+
+  /** Mix a word into a hash value. Every bit of the word affects the 
+   * upper half of the result, so that subsets differing by swapped 
+   * elements do not collide the way XOR folding does.
+   * @param h		the hash value of the preceding words
+   * @param word	the word to mix in
+   * @return		the new hash value
+   */
+  static word_t mix (word_t h, word_t word) {
+    h = (h ^ word) * golden;
+    return h ^ (h >> (wordBits / 2));
+  }
+  /** Reduce a hash value computed by mix to an unsigned integer
+   * @param h		the hash value
+   * @return		the hash value with all bits of h folded in
+   */
+  static unsigned fold (word_t h) {
+    h *= golden;
+    return unsigned (h ^ (h >> (wordBits / 2)));
   }
 
 private:
@@ -235,6 +277,10 @@ private:
   unsigned myAllocated;
   /** The vector */
   word_t* myBits;
+  /** An odd multiplier for hashing: the fractional part of the golden 
+   * ratio, truncated to the word size */
+  static const word_t golden =
+    ((word_t (0x9e3779b9ul) << (wordBits - 32)) ^ 0x7f4a7c15ul) | 1;
 };
 
 #endif // BITVECTOR_H_
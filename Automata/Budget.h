@@ -0,0 +1,127 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Budget.h
+ * Limits on the resources of a translation
+ */
+
+#ifndef BUDGET_H_
+#define BUDGET_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cstdio>
+#include <ctime>
+
+/**Limits on the number of states of the constructions, the peak 
+ * resident memory and the running time of a translation. The constructions 
+ * report their progress, and stop when a limit has been exceeded. 
+ * The time and the memory are only checked every checkInterval states,
+ * so the checks are cheap compared to the expansion of the states.
+ */
+class Budget {
+ public:
+  /**The constructions whose progress is tracked*/
+  enum Phase {nfa, reduction, dfa, minimal, numPhases};
+  /**The limits*/
+  enum Limit {none, nfaStates, dfaStates, residentMemory, runningTime};
+  /**Constructor of the class, without any limits*/
+  Budget();
+ private:
+  /**Copy constructor*/
+  Budget(const class Budget &old);
+  /**Assignment operator*/
+  class Budget & operator=(const class Budget &rhs);
+ public:
+  /**Set the limits from a comma separated list of nfa=N, dfa=N, 
+   * mem=megabytes and time=seconds
+   *@param limits The list
+   *@return true iff the list was valid
+   */
+  bool parse(const char *limits);
+  /**Record the number of states a construction has found
+   *@param phase The construction
+   *@param states The number of states found so far
+   *@return true iff the construction may continue
+   */
+  bool progress(enum Phase phase, unsigned states) {
+    if(myComplete[phase]) //run again, as for each component of a product
+      restart(phase);
+    myStates[phase]=states;
+    if(states > myMaxStates[phase]) {
+      myExceeded=phase==nfa ? nfaStates : dfaStates;
+      return false;
+    }
+    if(states < myNextCheck[phase])
+      return true;
+    myNextCheck[phase]=states + checkInterval;
+    return check();
+  }
+  /**Record the progress of a construction whose rounds are expensive
+   * compared to checking the time and the memory
+   *@param phase The construction
+   *@param states The number of states (or classes) found so far
+   *@return true iff the construction may continue
+   */
+  bool poll(enum Phase phase, unsigned states) {
+    if(myComplete[phase]) 
+      restart(phase);
+    myStates[phase]=states;
+    if(++myPolls < pollInterval)
+      return true;
+    myPolls=0;
+    return check();
+  }
+  /**Record that a construction has completed
+   *@param phase The construction
+   *@param states The number of states it found
+   */
+  void complete(enum Phase phase, unsigned states);
+  /**@return the limit that was exceeded, or none*/
+  enum Limit exceeded() const {return myExceeded;}
+  /**Print how far each construction got
+   *@param stream The output stream
+   */
+  void report(FILE *stream) const;
+ private:
+  /**Start a construction that has completed before
+   *@param phase The construction
+   */
+  void restart(enum Phase phase) {
+    myComplete[phase]=false;
+    myNextCheck[phase]=0;
+  }
+  /**Check the time and the memory limits
+   *@return true iff neither limit has been exceeded
+   */
+  bool check();
+  /**@return the peak resident memory in kilobytes*/
+  static unsigned long residentKB();
+
+  /**The number of states between checks of the time and the memory*/
+  static const unsigned checkInterval=4096;
+  /**The number of rounds between checks of the time and the memory*/
+  static const unsigned pollInterval=64;
+  /**The largest allowed number of states of each construction*/
+  unsigned myMaxStates[numPhases];
+  /**The largest allowed peak resident memory in kilobytes, or 0 if 
+   * unlimited
+   */
+  unsigned long myMaxMemory;
+  /**The largest allowed running time in seconds, or 0 if unlimited*/
+  unsigned long myMaxTime;
+  /**The time when the translation started*/
+  time_t myStart;
+  /**The number of states each construction has found*/
+  unsigned myStates[numPhases];
+  /**The number of states at which time and memory are checked next*/
+  unsigned myNextCheck[numPhases];
+  /**The number of rounds since the last check in poll*/
+  unsigned myPolls;
+  /**Flags the constructions that have completed*/
+  bool myComplete[numPhases];
+  /**The limit that was exceeded*/
+  enum Limit myExceeded;
+};
+
+#endif //BUDGET_H_
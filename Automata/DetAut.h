@@ -12,10 +12,35 @@
 
 #include "Automaton.h"
 #include "PairMap.h"
+#include <vector>
 
 
 class NonDetAut; //forward declaration
 
+/**Generator of the states of a deterministic automaton, for DetAut::explore.
+ * The states are numbered consecutively in the order they are found, 
+ * starting from the initial state 0.
+ */
+class RowGenerator {
+ public:
+  /**The destructor*/
+  virtual ~RowGenerator() {;}
+  /**@return the number of states found so far*/
+  virtual unsigned numStates() const=0;
+  /**@return true iff a state found so far is final*/
+  virtual bool isFinal(unsigned state) const=0;
+  /**Compute the successors of a state, numbering the states not found
+   * before after the ones found so far
+   * @param state The state
+   * @param row (output) the successor by each letter, or UINT_MAX for none
+   */
+  virtual void expand(unsigned state, unsigned *row)=0;
+};
+
+/**A complete deterministic automaton. The letters are partitioned into
+ * classes that have the same successor in every state, and the table
+ * of transitions only has a column for each class.
+ */
 class DetAut : public Automaton {
   
  public:
@@ -23,8 +48,11 @@ class DetAut : public Automaton {
    * @param size Number of states in the automaton
    * @param aSize Size of the alphabet
    * @param sets The number of accepting sets
+   * @param directory The directory of the file of the transitions, or 0
+   * for keeping them in memory
    */
-  DetAut(unsigned size, unsigned aSize, unsigned sets);
+  DetAut(unsigned size, unsigned aSize, unsigned sets, 
+	 const char *directory=0);
   /**The destructor*/
   ~DetAut();
   /**Get the successor of a state
@@ -34,7 +62,7 @@ class DetAut : public Automaton {
    */
   unsigned dest(unsigned source, unsigned label, unsigned index=0) const {
     assert(source<mySize && label<myAlphabetSize);
-    return myTransRel.get(source, label);    
+    return myTransRel.get(source, myClasses[label]);    
   }
   /**Return the number of successors for a state with a given label
    * @param state
@@ -42,23 +70,92 @@ class DetAut : public Automaton {
    * @return the number of successors 
    */
   unsigned numArcs(unsigned state, unsigned label) const {
-    return (myTransRel.isEmpty(state, label)) ? 0 : 1; 
+    assert(label<myAlphabetSize);
+    return (myTransRel.isEmpty(state, myClasses[label])) ? 0 : 1; 
   }
-  /**Add a transition
+  /**Add a transition. The letter gets a class of its own.
    * @param state
    * @param label
    * @param dest
    */
   void addTransition(unsigned state, unsigned label, unsigned dest) {
-    myTransRel.set(state, label, dest);
+    myTransRel.set(state, separate(label), dest);
   }
-  /**Delete a transition
+  /**Delete a transition. The letter gets a class of its own.
    * @param state
    * @param label 
    */
   void deleteTransition(unsigned state, unsigned label, unsigned index=0) {
-    myTransRel.clear(state, label);
+    myTransRel.clear(state, separate(label));
+  }
+  /**Set the transitions of a state by all letters, splitting the classes
+   * whose letters lead to different states
+   * @param state
+   * @param row the successor by each letter, or UINT_MAX for none
+   */
+  void setRow(unsigned state, const unsigned *row);
+  /**Construct the states reachable from the initial state 0 depth-first,
+   * replacing the transitions of the states found
+   * @param generator The generator of the states
+   * @param budget the limits of the construction, or 0
+   * @return false if the budget was exceeded before all states were found
+   */
+  bool explore(class RowGenerator &generator, class Budget *budget=0);
+  /**Collect the arcs leaving a state
+   * @param state
+   * @param arcs (output) map from destination state to label
+   */
+  void collectArcs(unsigned state, MultiMap &arcs) const;
+  /**Collect the arcs leaving a state, with the guards of the classes of
+   * the letters instead of the letters
+   * @param state
+   * @param arcs (output) map from destination state to guard
+   */
+  void collectGuards(unsigned state, GuardMap &arcs) const;
+  /**Compute the guards of the classes, so that several threads may
+   * collect the guards at the same time afterwards
+   */
+  void computeArcs() const;
+
+  /**@return the number of letter classes*/
+  unsigned numClasses() const {return myClassSize.size();}
+  /**@return the class of a letter*/
+  unsigned letterClass(unsigned label) const {
+    assert(label<myAlphabetSize);
+    return myClasses[label];
   }
+  /**Get the successor of a state by the letters of a class
+   * @param source The source state
+   * @param c The class
+   * @return The destination state
+   */
+  unsigned classDest(unsigned source, unsigned c) const {
+    return myTransRel.get(source, c);
+  }
+  /**@return the number of successors of a state by the letters of a class*/
+  unsigned numClassArcs(unsigned state, unsigned c) const {
+    return (myTransRel.isEmpty(state, c)) ? 0 : 1; 
+  }
+  /**Add a transition by the letters of a class
+   * @param state
+   * @param c
+   * @param dest
+   */
+  void addClassTransition(unsigned state, unsigned c, unsigned dest) {
+    myTransRel.set(state, c, dest);
+  }
+  /**Delete the transition by the letters of a class
+   * @param state
+   * @param c
+   */
+  void deleteClassTransition(unsigned state, unsigned c) {
+    myTransRel.clear(state, c);
+  }
+  /**Use the letter classes of another automaton over the same alphabet.
+   * The automaton must not have any transitions yet.
+   * @param other The other automaton
+   */
+  void copyClasses(const class DetAut &other);
   /**Check if a state belongs to a accepetance set
    * @param state  
    * @param set (output) the set the state belongs to
@@ -115,19 +212,48 @@ class DetAut : public Automaton {
    *@param asize the size of the alphabet
    */
   void grow(unsigned size, unsigned asize);
+  /**Number the states in breadth-first order from the initial state,
+   * which makes the states that are visited together close in memory.
+   * The unreachable states keep their order after the reachable ones.
+   */
+  void renumber();
   /**Construct a minimised version of the automaton using
    * Hopcroft's algorithm. Remember to deallocate the produced automaton.
-   * @return a minimal automaton   
+   * @param budget the limits of the minimisation, or 0
+   * @return a minimal automaton, or 0 if the budget was exceeded
    */
-  DetAut * minimise() const;
-  /**Interpret the automaton as a Bchi automaton and construct its complement 
+  DetAut * minimise(class Budget *budget=0) const;
+  /**Interpret the automaton as a Bchi automaton and construct its complement.
+   * The arcs of the complement are computed from *this when they are first
+   * needed, so *this must not be modified or destroyed before the result.
    * @return the complement of the Bchi automaton
    */ 
   NonDetAut *buchiComplement() const;
 
  private:
+  /**Add a class that has the transitions of another class
+   * @param c The other class
+   * @return the new class
+   */
+  unsigned newClass(unsigned c);
+  /**Move a letter to a class of its own
+   * @param label The letter
+   * @return the class of the letter
+   */
+  unsigned separate(unsigned label);
+
   class PairMap myTransRel;
   unsigned *myFinalSets;
+  /**The number of states that myFinalSets has room for*/
+  unsigned myAllocated;
+  /**The class of each letter*/
+  std::vector<unsigned> myClasses;
+  /**The number of letters in each class*/
+  std::vector<unsigned> myClassSize;
+  /**Map from class to the implicants of its letters, or empty if not
+   * computed since the classes changed
+   */
+  mutable GuardMap myClassGuards;
   unsigned myInitial;
   unsigned myNumFinal;
 };
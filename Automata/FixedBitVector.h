@@ -0,0 +1,118 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file FixedBitVector.h
+ * Bit vector whose width in words is known at compile time
+ */
+#ifndef FIXEDBITVECTOR_H_
+# define FIXEDBITVECTOR_H_
+# include <cassert>
+# include "BitVector.h"
+
+/** Binary digit (bit) vector of n words, stored inline. It has no size 
+ * header: all bits of the words belong to the vector. The loops run over
+ * a constant number of words, so that the compiler can unroll them.
+ */
+template<unsigned n>
+class FixedBitVector
+{
+public:
+  /** machine word */
+  typedef BitVector::word_t word_t;
+  /** number of bits in a word */
+  static const unsigned wordBits = CHAR_BIT * sizeof (word_t);
+
+  /** Constructor: an empty vector */
+  FixedBitVector () { clear (); }
+
+  /** Clear the vector */
+  void clear () {
+    for (unsigned i = 0; i < n; i++) myBits[i] = 0;
+  }
+
+  /** @return the words of the vector */
+  const word_t* getWords () const { return myBits; }
+  /** @return the words of the vector */
+  word_t* getWords () { return myBits; }
+
+  /** Read a binary digit
+   * @param index	zero-based index of the element
+   * @return		value of the binary digit
+   */
+  bool operator[] (unsigned index) const {
+    assert (index < n * wordBits);
+    return myBits[index / wordBits] & (word_t (1) << (index % wordBits));
+  }
+
+  /** Assign a binary digit
+   * @param index	zero-based index of the element
+   * @param value	new value of the digit
+   */
+  void assign (unsigned index, bool value) {
+    assert (index < n * wordBits);
+    word_t& word = myBits[index / wordBits];
+    word_t bit = word_t (1) << (index % wordBits);
+    if (value)
+      word |= bit;
+    else
+      word &= ~bit;
+  }
+
+  /** Equality comparison */
+  bool operator== (const class FixedBitVector<n>& other) const {
+    return equal (myBits, other.myBits);
+  }
+
+  /** Compute bit wise conjunction with the complement of a bit vector
+   * @param other	bit vector whose complement is to be ANDed with this
+   * @return		true if any bits were left '1' after the operation
+   */
+  bool andNot (const class FixedBitVector<n>& other) {
+    word_t left = 0;
+    for (unsigned i = 0; i < n; i++)
+      left |= myBits[i] &= ~other.myBits[i];
+    return left;
+  }
+
+  /** Check if the other bit vector intersects with this one
+   * @param other	bit vector to be checked against
+   * @return		true if the bit vectors are not disjoint
+   */
+  bool andPos (const class FixedBitVector<n>& other) const {
+    word_t common = 0;
+    for (unsigned i = 0; i < n; i++)
+      common |= myBits[i] & other.myBits[i];
+    return common;
+  }
+
+  /** @return hash value of the contents */
+  unsigned hash () const { return BitVector::fold (mix (myBits)); }
+
+  /** Compare n words
+   * @param a		the first words
+   * @param b		the second words
+   * @return		true iff the words are equal
+   */
+  static bool equal (const word_t* a, const word_t* b) {
+    word_t diff = 0;
+    for (unsigned i = 0; i < n; i++)
+      diff |= a[i] ^ b[i];
+    return !diff;
+  }
+
+  /** Mix n words into a hash value
+   * @param words	the words
+   * @param h		the hash value of the preceding words
+   * @return		the hash value, to be reduced with BitVector::fold
+   */
+  static word_t mix (const word_t* words, word_t h = 0) {
+    for (unsigned i = 0; i < n; i++)
+      h = BitVector::mix (h, words[i]);
+    return h;
+  }
+
+private:
+  /** The vector */
+  word_t myBits[n];
+};
+
+#endif // FIXEDBITVECTOR_H_
@@ -22,6 +22,16 @@ class Implicant {
       myValues[i]=False;
     }
   }
+  /**Constructor of the class
+   * @param size The number of variables
+   * @param value The value given to all variables
+   */
+  explicit Implicant(unsigned size, enum Value value): mySize(size) {
+    myValues = new Value[mySize];
+    for(unsigned i=mySize; i--; ) {
+      myValues[i]=value;
+    }
+  }
   /**Initialise the implicant with an array
    *@param implicant array to use for initialisation
    *@unsigned size Size of the array
@@ -116,6 +126,11 @@ class Implicant {
    * @return true iff other covers *this
    */
   bool covers(const class Implicant &other) const;
+  /**Check if *this implicant and another implicant have a common term
+   * @param other
+   * @return true iff some term is covered by both implicants
+   */
+  bool intersects(const class Implicant &other) const;
   /**Check if *this implicant covers the given term
    * @param term 
    * @return true iff *this covers term
@@ -140,6 +155,23 @@ class Implicant {
    * @param other implicant to join with *this
    */
   void join(const class Implicant &other);
+  /**Conjunction in three-valued logic, where DC is unknown*/
+  static enum Value kleeneAnd(enum Value a, enum Value b) {
+    if(a==False || b==False) return False;
+    if(a==DC || b==DC) return DC;
+    return True;
+  }
+  /**Disjunction in three-valued logic, where DC is unknown*/
+  static enum Value kleeneOr(enum Value a, enum Value b) {
+    if(a==True || b==True) return True;
+    if(a==DC || b==DC) return DC;
+    return False;
+  }
+  /**Negation in three-valued logic, where DC is unknown*/
+  static enum Value kleeneNot(enum Value a) {
+    if(a==DC) return DC;
+    return (a==True) ? False : True;
+  }
 
 private:
   /**Array for storing values*/
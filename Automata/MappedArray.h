@@ -0,0 +1,112 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file MappedArray.h
+ * Growable array of integers, optionally kept in a memory-mapped file
+ */
+
+#ifndef MAPPEDARRAY_H_
+#define MAPPEDARRAY_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <cstring>
+#include <cstddef>
+
+/**Memory for a growable array. The memory is allocated either from the
+ * heap or from an unlinked temporary file that is mapped into memory. 
+ * The pages of a file can be written out by the kernel, so the size of
+ * the array is bounded by the disk rather than by the memory available.
+ */
+class MappedMemory {
+ protected:
+  /**Constructor of the class
+   *@param directory The directory of the file, or 0 for keeping the
+   * array in memory
+   */
+  explicit MappedMemory(const char *directory);
+  /**The destructor*/
+  ~MappedMemory();
+ private:
+  /**Copy constructor*/
+  MappedMemory(const class MappedMemory &old);
+  /**Assignment operator*/
+  class MappedMemory & operator=(const class MappedMemory &rhs);
+ protected:
+  /**Make room for more elements, at least doubling the room there is.
+   * Exit with an error message if the room cannot be allocated.
+   *@param used The number of elements in use
+   *@param count The number of elements to add
+   *@param width The size of an element in bytes
+   *@return the number of elements there is room for
+   */
+  size_t reserve(size_t used, size_t count, size_t width);
+
+  /**The descriptor of the file, or -1 if the array is in memory*/
+  int myFile;
+  /**The memory*/
+  void *myMemory;
+  /**The size of the memory in bytes*/
+  size_t myLength;
+};
+
+/**A growable array of integers, kept in memory or in a mapped file*/
+template<class Integer>
+class MappedArray : private MappedMemory {
+ public:
+  /**Constructor of the class
+   *@param directory The directory of the file, or 0 for keeping the
+   * array in memory
+   */
+  explicit MappedArray(const char *directory=0) :
+    MappedMemory(directory), mySize(0), myCapacity(0) {;}
+  /**@return the number of integers*/
+  size_t size() const {return mySize;}
+  /**@return the integer at an index*/
+  Integer operator[](size_t index) const {
+    assert(index<mySize);
+    return data()[index];
+  }
+  /**@return the integers starting at an index, valid until the array grows*/
+  const Integer *data(size_t index) const {
+    assert(index<mySize);
+    return data() + index;
+  }
+  /**@return the integers starting at an index, valid until the array grows*/
+  Integer *data(size_t index) {
+    assert(index<mySize);
+    return data() + index;
+  }
+  /**Append integers to the array
+   *@param values The integers
+   *@param count The number of integers
+   */
+  void append(const Integer *values, size_t count) {
+    if(count > myCapacity - mySize) 
+      myCapacity=reserve(mySize, count, sizeof *values);
+    memcpy(data() + mySize, values, count * sizeof *values);
+    mySize+=count;
+  }
+  /**Append an integer to the array*/
+  void push_back(Integer value) {append(&value, 1);}
+  /**Append zeros to the array
+   *@param count The number of zeros
+   */
+  void extend(size_t count) {
+    if(count > myCapacity - mySize) 
+      myCapacity=reserve(mySize, count, sizeof(Integer));
+    memset(data() + mySize, 0, count * sizeof(Integer));
+    mySize+=count;
+  }
+ private:
+  /**@return the integers*/
+  Integer *data() const {return static_cast<Integer *>(myMemory);}
+
+  /**The number of integers*/
+  size_t mySize;
+  /**The number of integers there is room for*/
+  size_t myCapacity;
+};
+
+#endif //MAPPEDARRAY_H_
@@ -1,11 +1,15 @@
 // 2003 Timo Latvala (timo.latvala@hut.fi). See the file COPYING for details
 
 /** @file MultiMap.h
- * Define a multi-mapping from unsigned to unsigned 
+ * Define a multi-mapping from unsigned to unsigned, and from unsigned
+ * to guards
  */
 
 #ifndef MULTIMAP_H_
 #define MULTIMAP_H_
 #include <map>
+#include "Implicant.h"
 typedef std::multimap<unsigned, unsigned> MultiMap;
+/**Map from a destination state to the guards of the arcs leading to it*/
+typedef std::multimap<unsigned, class Implicant> GuardMap;
 #endif //MULTIMAP_H_
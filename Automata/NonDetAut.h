@@ -11,18 +11,31 @@
 #endif //__GNUC__
 #include "Automaton.h"
 #include "TransRel.h"
+#include "ArcTable.h"
 #include "BitVector.h"
 
+/**Generator of the arcs of a lazily constructed automaton*/
+class ArcGenerator {
+ public:
+  /**The destructor*/
+  virtual ~ArcGenerator() {;}
+  /**Compute the arcs leaving a state
+   * @param state The source state
+   * @param arcs (output) the transition relation the arcs are added to
+   */
+  virtual void generate(unsigned state, TransRel &arcs) const=0;
+};
+
 class NonDetAut : public Automaton  {
 
  public:
   
   /**Constructor of the class
    * @param size The number of states in the automaton
-   * @param aSize The size of the alphabet
+   * @param numAP The number of atomic propositions of the alphabet
    * @param sets The number of accepting sets 
    */
-  NonDetAut(unsigned size, unsigned aSize, unsigned sets);
+  NonDetAut(unsigned size, unsigned numAP, unsigned sets);
   /**The destructor*/
   ~NonDetAut();
   /**Add transition
@@ -32,7 +45,18 @@ class NonDetAut : public Automaton  {
    */
   void addTransition(unsigned source, unsigned label, unsigned dest) {
     assert(source<mySize && label<myAlphabetSize && dest<mySize);
-    myTransRel.insert(TransRel::value_type(UIPair(source, label), dest));
+    addTransition(source, Implicant(label, myNumAP), dest);
+    return;
+  }
+  /**Add a guarded transition
+   * @param source Id of the source state
+   * @param guard The letters enabling the transition
+   * @param dest Id of the destination state
+   */
+  void addTransition(unsigned source, const class Implicant &guard, unsigned dest) {
+    assert(source<mySize && guard.size()==myNumAP && dest<mySize);
+    if(myArcs.isStored(source)) myArcs.release(source, myTransRel);
+    myTransRel.insert(TransRel::value_type(source, GuardArc(guard, dest)));
     return;
   }
   /**Delete a transition
@@ -40,16 +64,7 @@ class NonDetAut : public Automaton  {
    * @param label Label of the transition
    * @param dest Id of the destination state
    */
-  void deleteTransition(unsigned source, unsigned label, unsigned dest) {
-    assert(source <= mySize && label<myAlphabetSize && dest<mySize);
-    for(std::pair<TransRel::iterator, TransRel::iterator> p=myTransRel.equal_range(UIPair(source, label));
-	p.first!=p.second; ++p.first) {
-      if((*p.first).second == dest) {
-	myTransRel.erase(p.first);
-	return;
-      }
-    }
-  }
+  void deleteTransition(unsigned source, unsigned label, unsigned dest);
   /**Return the name of a target state. The method does not fail even if the
    * requested destination does not exist. Use the method numArcs to check
    * the given result is correct.
@@ -61,11 +76,9 @@ class NonDetAut : public Automaton  {
   unsigned dest(unsigned source, unsigned label, unsigned index) const {
     assert(source < mySize && label<myAlphabetSize);
     unsigned j=0;
-    for(std::pair<TransRel::const_iterator, TransRel::const_iterator> 
-	  p=myTransRel.equal_range(UIPair(source, label));
-    	p.first!=p.second; ++p.first) {
-      if(index == j++ ) {
-      	return (*p.first).second;
+    for(ArcTable::Span p=arcs(source); p.first!=p.second; ++p.first) {
+      if((*p.first).guard.covers(label) && index == j++ ) {
+      	return (*p.first).dest;
       }
     }
     return 0;
@@ -73,8 +86,50 @@ class NonDetAut : public Automaton  {
   /**@return Number of arcs with the given source and label*/  
   unsigned numArcs(unsigned source, unsigned label) const {
     assert(source<mySize && label<myAlphabetSize);
-    return myTransRel.count(UIPair(source, label));
+    unsigned count=0;
+    for(ArcTable::Span p=arcs(source); p.first!=p.second; ++p.first) {
+      if((*p.first).guard.covers(label))
+	count++;
+    }
+    return count;
   }
+  /**@return The guarded arcs leaving the given state, valid until arcs 
+   * are added to or deleted from the state
+   */
+  ArcTable::Span arcs(unsigned source) const {
+    assert(source<mySize);
+    if(!myArcs.isStored(source)) generate(source);
+    return myArcs.arcs(source);
+  }
+  /**Collect the arcs leaving a state, expanding the guards into letters
+   * @param state
+   * @param arcs (output) map from destination state to label
+   */
+  void collectArcs(unsigned state, MultiMap &arcs) const;
+  /**Collect the arcs leaving a state with their guards
+   * @param state
+   * @param arcs (output) map from destination state to guard
+   */
+  void collectGuards(unsigned state, GuardMap &arcs) const;
+  /**Move the arcs of all states to the arc table, generating them first
+   * in a lazy automaton
+   */
+  void computeArcs() const;
+  /**Split the letters into disjoint implicants, the parts, so that every
+   * guard is a union of parts
+   * @param arcGuards (output) the number of the guard of each arc, 
+   * state by state
+   * @param guardParts (output) the parts of each guard
+   * @return the number of parts
+   */
+  unsigned splitGuards(std::vector<unsigned> &arcGuards,
+		       std::vector<std::vector<unsigned> > &guardParts) const;
+  /**@return true iff no state is entered from two states on a common
+   * letter
+   */
+  bool isCoDeterministic() const;
+  /**@return The number of atomic propositions of the alphabet*/
+  unsigned numAtoms() const {return myNumAP;}
   /*Check if a state belongs to a final set
    * @param state
    * @param set (output) the set the state belongs to
@@ -126,20 +181,91 @@ class NonDetAut : public Automaton  {
   }
   /**Increase the size of the automaton*/
   void grow(unsigned size, unsigned asize);
+  /**Compute the arcs of each state only when they are first needed. 
+   * The automaton takes the ownership of the generator.
+   * @param generator The generator of the arcs
+   */
+  void setGenerator(const class ArcGenerator *generator);
   /**Create a finite automaton corresponding to a safety formula     
    *@param f formula to be translated
-   *@return the corresponding finite automaton
+   *@param threads the number of threads used for exploring the states
+   *@param budget the limits of the construction, or 0
+   *@return the corresponding finite automaton, or 0 if the budget was
+   * exceeded
+   *@precond f must be in negation normal form
+   */  
+  static NonDetAut* create(const class Formula &f, unsigned threads=1,
+			   class Budget *budget=0); 
+  /**Number the subformulas of a formula and compile the rules of its
+   * rcl subset, as done by create
+   *@param f formula to be translated
+   *@return the rules, to be deleted by the caller
    *@precond f must be in negation normal form
    */  
-  static NonDetAut* create(const class Formula &f); 
+  static class Program* compile(const class Formula &f); 
   /**Determinze this nondet automaton
    *@param result Place holder for the result
+   *@param simulation The simulation preorder of this automaton, for
+   * removing simulated states from the subsets, or 0
+   *@param threads the number of threads used for computing the successors
+   *@param directory the directory of the files the subsets are kept in,
+   * or 0 for keeping them in memory
+   *@param budget the limits of the construction, or 0. The result is
+   * incomplete if the budget was exceeded.
    */
-  void determinize(class DetAut &result) const;
+  void determinize(class DetAut &result, 
+		   const class Simulation *simulation=0,
+		   unsigned threads=1, const char *directory=0,
+		   class Budget *budget=0) const;
+  /**Merge classes of states that accept the same words
+   *@param classes The class of each state, numbered in the order of 
+   * their smallest states
+   *@param size The number of classes
+   *@return the quotient automaton, accepting the same language
+   */
+  NonDetAut *quotient(const unsigned *classes, unsigned size) const;
  
  private:
-  /**The transition relation*/
-  TransRel myTransRel;
+  /**Determinize this nondet automaton, computing the successor subsets 
+   * in vectors of type Vector
+   *@param result Place holder for the result
+   *@param dest Work space for the successor subsets
+   *@param simulation The simulation preorder for pruning the subsets, or 0
+   *@param directory the directory of the files of the subsets, or 0
+   *@param budget the limits of the construction, or 0
+   */
+  template<class Vector> 
+  void determinize(class DetAut &result, Vector &dest,
+		   const class Simulation *simulation,
+		   const char *directory, class Budget *budget) const;
+  /**Determinize this nondet automaton, expanding the subsets in batches 
+   * on several threads. The states are renumbered as determinize would
+   * number them on a single thread.
+   *@param result Place holder for the result
+   *@param simulation The simulation preorder for pruning the subsets, or 0
+   *@param threads the number of threads
+   *@param directory the directory of the files of the subsets, or 0
+   *@param budget the limits of the construction, or 0
+   */
+  void determinizeParallel(class DetAut &result, 
+			   const class Simulation *simulation,
+			   unsigned threads, const char *directory,
+			   class Budget *budget) const;
+  /**Move the arcs of a state to the arc table, generating them first
+   * in a lazy automaton
+   * @param state
+   */
+  void generate(unsigned state) const;
+  /**The arcs added to states whose arcs have not been queried yet*/
+  mutable TransRel myTransRel;
+  /**The arcs of the states whose arcs have been queried*/
+  mutable class ArcTable myArcs;
+  /**The generator of the arcs of a lazy automaton*/
+  const class ArcGenerator *myGenerator;
+  /**Flags the states whose arcs have been generated*/
+  mutable class BitVector myGenerated;
+  /**The number of atomic propositions (the alphabet is their powerset)*/
+  unsigned myNumAP;
   /**Store acceptance sets for state*/
   unsigned *myFinalSets;
   /**Initial state information*/
@@ -153,5 +279,12 @@ class NonDetAut : public Automaton  {
  */
 NonDetAut *buchiread(const char *translator, const class Formula &f);
 
+/**Read an automaton in the output format of scheck
+ * @param input The stream the automaton is read from
+ * @param f Formula whose atomic propositions the arcs refer to
+ * @return the automaton, or 0 if it could not be read
+ */
+NonDetAut *readAut(FILE *input, const class Formula &f);
+
 #endif //NONDETAUT_H_
 
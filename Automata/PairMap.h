@@ -11,12 +11,22 @@
 #endif // __GNUC__
 
 #include <cassert>
+#include <cstddef>
+template<class Integer> class MappedArray;
+/**A table of the successors of states by labels. The rows of the states
+ * are in one array, and the elements are 16 bits wide until a value
+ * does not fit in them. The array is kept in memory or in a mapped file.
+ */
 class PairMap {
  public:
   /**Constructor of the class
-   *@param size Number of pairs to map
+   *@param xsize Number of states
+   *@param ysize Number of labels
+   *@param directory The directory of the file of the rows, or 0 for
+   * keeping them in memory
    */
-  explicit PairMap(unsigned xsize=1, unsigned ysize=1);
+  explicit PairMap(unsigned xsize=1, unsigned ysize=1, 
+		   const char *directory=0);
   /**The destructor*/
   ~PairMap();
  private:
@@ -25,19 +35,23 @@ class PairMap {
   /**Assignment operator*/
   class PairMap & operator=(const class PairMap &rhs);
  public:
-  /**Extend the map
+  /**Resize the map. The capacity of the map grows geometrically, and
+   * the new slots are empty.
    * @param xsize The new xsize of the map
-   * @param ysize The new ysize of the map
+   * @param ysize The new ysize of the map, at least the current one
    */
   void grow(unsigned xsize, unsigned ysize);
+  /**Exchange the contents of two maps
+   * @param other The other map
+   */
+  void swap(class PairMap &other);
   /**Get an element 
    * @param state
    * @param label
    * @return the element
    */
   unsigned get(unsigned state, unsigned label) const {
-    assert(state<myXSize && label<myYSize);
-    return myMap[state][label]-1;
+    return slot(state, label)-1;
   }
   /**Set an element 
    * @param state
@@ -46,7 +60,14 @@ class PairMap {
    */
   void set(unsigned state, unsigned label, unsigned dest) {
     assert(state<myXSize && label<myYSize);
-    myMap[state][label]=++dest;
+    if(myShort) {
+      if(dest < maxShort) {
+	myShort[index(state, label)]=++dest;
+	return;
+      }
+      widen();
+    }
+    myLong[index(state, label)]=++dest;
     return;
   }
   /**Clear a slot 
@@ -55,7 +76,8 @@ class PairMap {
    */
   void clear(unsigned state, unsigned label) {
     assert(state<myXSize && label < myYSize);
-    myMap[state][label]=0;
+    if(myShort) myShort[index(state, label)]=0;
+    else myLong[index(state, label)]=0;
     return;
   }
   /**Check if a slot is empty
@@ -64,21 +86,44 @@ class PairMap {
    * @return true iff the slot is empty
    */
   bool isEmpty(unsigned state, unsigned label) const {
-    assert(state<myXSize && label<myYSize);
-    return myMap[state][label]==0;
+    return slot(state, label)==0;
   }
   /**@return the number of states*/
   unsigned numStates() const {return myXSize;}
   /**@return the alphabet size*/
   unsigned numAlphbet() const {return myYSize;}
+  /**@return the directory of the file of the rows, or 0*/
+  const char *directory() const {return myDirectory;}
 
  private:
+  /**The largest value stored in 16 bits*/
+  static const unsigned maxShort=0xffff;
+  /**@return the index of a slot in the array*/
+  size_t index(unsigned state, unsigned label) const {
+    return size_t(state) * myYAllocated + label;
+  }
+  /**@return the value of a slot, the element plus one or 0 if empty*/
+  unsigned slot(unsigned state, unsigned label) const {
+    assert(state<myXSize && label<myYSize);
+    return myShort ? myShort[index(state, label)] : myLong[index(state, label)];
+  }
+  /**Convert the elements to 32 bits*/
+  void widen();
+
   unsigned myXSize;
   unsigned myYSize;
   unsigned myXAllocated;
   unsigned myYAllocated;
-  unsigned **myMap;
-
+  /**The directory of the file of the rows, or 0*/
+  const char *myDirectory;
+  /**The array of the slots when they are 16 bits wide, or 0*/
+  class MappedArray<unsigned short> *myShortRows;
+  /**The array of the slots when they are 32 bits wide, or 0*/
+  class MappedArray<unsigned> *myLongRows;
+  /**The slots, row by row, when they are 16 bits wide, or 0*/
+  unsigned short *myShort;
+  /**The slots, row by row, when they are 32 bits wide, or 0*/
+  unsigned *myLong;
 };
 
 #endif //PAIRMAP_H_
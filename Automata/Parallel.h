@@ -0,0 +1,29 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Parallel.h
+ * Run independent work items on several threads
+ */
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+/**The work done for one item
+ * @param context The data shared by all items
+ * @param thread The number of the thread doing the work, less than threads
+ * @param item The number of the item
+ */
+typedef void (*WorkFunction)(void *context, unsigned thread, unsigned item);
+
+/**Do the work for the items 0..size-1. The items are claimed dynamically
+ * in small chunks, so the threads share the work even if the items are 
+ * of uneven cost. Returns when all items are done. The threads are 
+ * created by the first call and wait for the next call afterwards. The
+ * work function must not call parallelFor.
+ * @param threads The number of threads to use (at least 1)
+ * @param size The number of items
+ * @param work The work function
+ * @param context The data passed to the work function
+ */
+void parallelFor(unsigned threads, unsigned size, WorkFunction work, void *context);
+
+#endif //PARALLEL_H_
@@ -0,0 +1,81 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Partition.h
+ * Partition of the states of an automaton for refinement
+ */
+#ifndef PARTITION_H_
+# define PARTITION_H_
+# include <vector>
+# include <climits>
+
+/**A partition of the states of an automaton into blocks. The states of
+ * each block are consecutive in an array, and the states of a block that
+ * have been marked for splitting it are at the start of its range.
+ */
+struct Partition {
+  /**Constructor, with all states in one block
+   * @param size The number of states
+   */
+  explicit Partition(unsigned size) :
+    elements(size), location(size), block(size, 0), first(1, 0), 
+    end(1, size), marked(1, 0) {
+    for(unsigned i=size; i--; ) elements[i]=location[i]=i;
+  }
+  /**@return the number of blocks*/
+  unsigned size() const {return first.size();}
+  /**Mark a state for splitting its block
+   * @param state The state
+   * @param touched (in/out) the blocks with marked states
+   */
+  void mark(unsigned state, std::vector<unsigned> &touched) {
+    const unsigned b=block[state];
+    const unsigned i=location[state];
+    const unsigned j=first[b] + marked[b];
+    if(i < j) return; //marked before
+    if(!marked[b]++) touched.push_back(b);
+    elements[i]=elements[j];
+    location[elements[i]]=i;
+    elements[j]=state;
+    location[state]=j;
+  }
+  /**Split a block into its marked and unmarked states. The smaller 
+   * part becomes a new block, so a state changes its block at most
+   * log n times.
+   * @param b The block
+   * @return the new block, or UINT_MAX if all states were marked
+   */
+  unsigned split(unsigned b) {
+    const unsigned middle=first[b] + marked[b];
+    marked[b]=0;
+    if(middle==end[b]) return UINT_MAX;
+    const unsigned n=first.size();
+    if(middle - first[b] <= end[b] - middle) {
+      first.push_back(first[b]);
+      end.push_back(middle);
+      first[b]=middle;
+    }
+    else {
+      first.push_back(middle);
+      end.push_back(end[b]);
+      end[b]=middle;
+    }
+    marked.push_back(0);
+    for(unsigned i=first[n]; i<end[n]; i++) 
+      block[elements[i]]=n;
+    return n;
+  }
+  /**The states, grouped by block*/
+  std::vector<unsigned> elements;
+  /**The index of each state in elements*/
+  std::vector<unsigned> location;
+  /**The block of each state*/
+  std::vector<unsigned> block;
+  /**The index of the first state of each block in elements*/
+  std::vector<unsigned> first;
+  /**The index past the last state of each block in elements*/
+  std::vector<unsigned> end;
+  /**The number of marked states of each block*/
+  std::vector<unsigned> marked;
+};
+
+#endif // PARTITION_H_
@@ -14,8 +14,10 @@ typedef struct _IO_FILE FILE;
 /**Print an automaton with labels
  * @param automaton Automaton to be printed
  * @param f Formula used to construct the automaton
+ * @param threads The number of threads minimising the labels
  */
 void
-printLabelAut(FILE *stream, const class Automaton & automaton, const class Formula &f);
+printLabelAut(FILE *stream, const class Automaton & automaton, const class Formula &f,
+	      unsigned threads=1);
 
 #endif //PRINTAUT_H_
@@ -0,0 +1,73 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Product.h
+ * The product of deterministic automata over disjoint propositions
+ */
+
+#ifndef PRODUCT_H_
+#define PRODUCT_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <vector>
+
+class DetAut;
+
+/**The intersection of deterministic automata whose atomic propositions
+ * are disjoint subsets of the propositions of the product. A letter of 
+ * the product is projected to a letter of each component. Only the 
+ * reachable tuples of component states are constructed, and the tuples
+ * containing a state from which no final state is reachable are 
+ * collapsed into one.
+ */
+class Product {
+ public:
+  /**Constructor of the class
+   *@param numAP The number of atomic propositions of the product
+   */
+  explicit Product(unsigned numAP);
+  /**The destructor*/
+  ~Product();
+ private:
+  /**Copy constructor*/
+  Product(const class Product &old);
+  /**Assignment operator*/
+  class Product & operator=(const class Product &rhs);
+ public:
+  /**Add a component. The product takes the ownership of the automaton.
+   *@param component A complete deterministic automaton
+   *@param aps The number in the product of each atomic proposition of 
+   * the component
+   */
+  void add(class DetAut *component, const std::vector<unsigned> &aps);
+  /**Construct the product
+   *@param result Place holder for the result
+   *@param budget the limits of the construction, or 0
+   *@return false if the budget was exceeded and result is incomplete
+   */
+  bool build(class DetAut &result, class Budget *budget=0);
+ private:
+  /**@return The letter of a component for a letter of the product*/
+  unsigned project(unsigned c, unsigned letter) const {
+    unsigned result=0;
+    for(unsigned k=myAPs[c].size(); k--; ) 
+      if(letter & (1u << myAPs[c][k])) result|=1u << k;
+    return result;
+  }
+  /**The tuples explored by build*/
+  class Rows;
+
+  /**The number of atomic propositions*/
+  unsigned myNumAP;
+  /**The components*/
+  std::vector<class DetAut *> myComponents;
+  /**The number in the product of each atomic proposition of each component*/
+  std::vector<std::vector<unsigned> > myAPs;
+  /**The state of each component from which no final state is reachable,
+   * or UINT_MAX
+   */
+  std::vector<unsigned> myDead;
+};
+
+#endif //PRODUCT_H_
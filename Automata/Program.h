@@ -0,0 +1,126 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Program.h
+ * The rules of the rcl subset of a formula compiled into a flat 
+ * instruction array
+ */
+
+#ifndef PROGRAM_H_
+#define PROGRAM_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <climits>
+#include "Implicant.h"
+#include "StateStore.h"
+
+class Formula;
+class BitVector;
+
+class Program {
+ public:
+  /**A set of letters, one letter per bit*/
+  typedef unsigned long Lanes;
+  /**The number of letters evaluated at once*/
+  static const unsigned laneBits=CHAR_BIT * sizeof(Lanes);
+  /**@return the number of aps whose letters fit in one Lanes word*/
+  static unsigned laneLevel() {
+    unsigned level=0;
+    while((2ul << level) <= laneBits) level++;
+    return level;
+  }
+  /**Constructor of the class. The subformulas must be numbered in
+   * post-order with Formula::setNum.
+   * @param f The formula
+   * @param rclmember bitvector with true for each subformula in the rcl set
+   * @param apmap mapping from ap number to formula index
+   * @param numAP The number of atomic propositions
+   */
+  explicit Program(const class Formula &f, const class BitVector &rclmember,
+		   const unsigned *apmap, unsigned numAP);
+  /**The destructor*/
+  ~Program();
+ private:
+  /**Copy constructor*/
+  Program(const class Program &old);
+  /**Assignment operator*/
+  class Program & operator=(const class Program &rhs);
+ public:
+  /**@return The number of subformulas*/
+  unsigned size() const {return mySize;}
+  /**@return The number of atomic propositions*/
+  unsigned numAP() const {return myNumAP;}
+  /**@return The number of subformulas in the rcl set*/
+  unsigned numRcl() const {return myNumRcl;}
+  /**@return The formula index of an rcl subformula*/
+  unsigned rcl(unsigned i) const {
+    assert(i<myNumRcl);
+    return myRcl[i];
+  }
+  /**Evaluate the subformulas in a state, when no atomic proposition holds.
+   * This part of the rules only depends on the source state.
+   * @param state The words of the state, as stored in a StateStore
+   * @param now (output) the truth value of each subformula 
+   */
+  void evalState(const StateStore::word_t *state, bool *now) const;
+  /**Evaluate the rules for a guard in three-valued logic, where DC is unknown
+   * @param now The truth values computed by evalState
+   * @param guard The letters under consideration
+   * @param values (output) the truth value of each subformula 
+   */
+  void evalGuard(const bool *now, const class Implicant &guard, 
+		 enum Implicant::Value *values) const;
+  /**Evaluate the rules for all letters of a guard at once. Bit k of
+   * a value corresponds to the letter whose first level aps are the 
+   * bits of k.
+   * @param now The truth values computed by evalState
+   * @param guard The letters under consideration 
+   * @param level The number of aps not fixed by the guard
+   * @param values (output) the letters for which each subformula holds
+   */
+  void evalLanes(const bool *now, const class Implicant &guard, unsigned level,
+		 Lanes *values) const;
+  /**Evaluate the rules symbolically, as functions of the values of the
+   * rcl subformulas at the next position and of the atomic propositions
+   * @param bdd The BDD package
+   * @param next The value of each rcl subformula at the next position,
+   * indexed by formula index
+   * @param aps The value of each atomic proposition
+   * @param values (output) the value of each subformula
+   */
+  void evalSymbolic(class Bdd &bdd, const unsigned *next, const unsigned *aps,
+		    unsigned *values) const;
+ private:
+  /**The operations of the instructions*/
+  enum Op {opFalse, opTrue, opAtom, opNot, opAnd, opOr, 
+	   opNext, opGlobally, opFinally, opUntil, opRelease};
+  /**An instruction computes the value of one subformula from the values
+   * of its operands, which have smaller indices
+   */
+  struct Instruction {
+    /**The operation*/
+    enum Op op;
+    /**True iff the subformula belongs to the rcl set*/
+    bool rcl;
+    /**The first operand, or the ap number of an atom*/
+    unsigned lhs;
+    /**The second operand*/
+    unsigned rhs;
+  };
+  /**The instructions indexed by formula index*/
+  struct Instruction *myCode;
+  /**The number of instructions*/
+  unsigned mySize;
+  /**The formula indices of the rcl subformulas*/
+  unsigned *myRcl;
+  /**The number of rcl subformulas*/
+  unsigned myNumRcl;
+  /**The number of atomic propositions*/
+  unsigned myNumAP;
+  /**The letters for which each of the first laneLevel() aps holds*/
+  Lanes myPattern[CHAR_BIT * sizeof(Lanes)];
+};
+
+#endif //PROGRAM_H_
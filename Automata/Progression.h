@@ -0,0 +1,82 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Progression.h
+ * Construct a deterministic automaton by formula progression
+ */
+
+#ifndef PROGRESSION_H_
+#define PROGRESSION_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <vector>
+
+class Formula;
+class DetAut;
+
+/**Construct a deterministic finite automaton for a formula by rewriting
+ * it letter by letter. A state is a residual formula: a monotone 
+ * disjunction of conjunctions of subformulas that must hold from the next
+ * position on. The residuals are kept in a canonical form (sorted, with 
+ * absorbed conjunctions removed), so that equal residuals are found by 
+ * hashing. The automaton accepts the same words as the determinized
+ * automaton of NonDetAut::create, so both minimise to the same automaton.
+ */
+class Progression {
+ public:
+  /**A conjunction of subformulas, by increasing number*/
+  typedef std::vector<unsigned> Term;
+  /**A disjunction of conjunctions, in canonical form*/
+  typedef std::vector<Term> Residual;
+  /**Constructor of the class
+   *@param f The formula, in negation normal form
+   */
+  explicit Progression(const class Formula &f);
+  /**The destructor*/
+  ~Progression();
+ private:
+  /**Copy constructor*/
+  Progression(const class Progression &old);
+  /**Assignment operator*/
+  class Progression & operator=(const class Progression &rhs);
+ public:
+  /**Construct the automaton
+   *@param result Place holder for the result
+   *@param budget the limits of the construction, or 0
+   *@return false if the budget was exceeded and result is incomplete
+   */
+  bool build(class DetAut &result, class Budget *budget=0);
+ private:
+  /**Compute the residual of a subformula after a letter
+   *@param num The number of the subformula
+   *@param letter The letter
+   *@return the residual, valid until the next letter
+   */
+  const Residual &progress(unsigned num, unsigned letter);
+  /**Compute the residual of a residual after a letter
+   *@param residual The residual
+   *@param letter The letter
+   *@param result (output) the residual after the letter
+   */
+  void progress(const Residual &residual, unsigned letter, Residual &result);
+  /**The residuals explored by build*/
+  class Rows;
+
+  /**The subformulas by number*/
+  std::vector<const class Formula *> mySubformulas;
+  /**The number of the atomic proposition of each atom subformula*/
+  std::vector<unsigned> myAtoms;
+  /**The number of the formula*/
+  unsigned myRoot;
+  /**The number of atomic propositions*/
+  unsigned myNumAP;
+  /**The residuals of the subformulas after the current letter*/
+  std::vector<Residual> myMemo;
+  /**The letter for which each residual in myMemo was computed, plus one*/
+  std::vector<unsigned> myStamps;
+  /**The current stamp*/
+  unsigned myStamp;
+};
+
+#endif //PROGRESSION_H_
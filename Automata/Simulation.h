@@ -0,0 +1,95 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Simulation.h
+ * Direct simulation preorder of a nondeterministic automaton
+ */
+
+#ifndef SIMULATION_H_
+#define SIMULATION_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <vector>
+#include "BitVector.h"
+
+class NonDetAut;
+
+/**The direct simulation preorder of a nondeterministic finite automaton.
+ * A state p simulates a state q if p is final whenever q is, and every 
+ * arc of q can be matched by an arc of p on the same letter to a state 
+ * simulating the destination. Then p accepts every word q accepts.
+ */
+class Simulation {
+ public:
+  /**The machine word of the subsets*/
+  typedef BitVector::word_t word_t;
+  /**Constructor of the class: compute the greatest simulation
+   *@param aut The automaton
+   *@param budget the limits of the computation, or 0. If a limit is 
+   * exceeded, the preorder is left too coarse and must not be used.
+   */
+  explicit Simulation(const class NonDetAut &aut, class Budget *budget=0);
+  /**Constructor of the class: the simulation preorder of the quotient of
+   * an automaton by the classes of states that simulate each other
+   *@param simulation The simulation preorder of the automaton
+   *@param classes The class of each state, as computed by classes()
+   *@param size The number of classes
+   */
+  Simulation(const class Simulation &simulation, const unsigned *classes,
+	     unsigned size);
+  /**The destructor*/
+  ~Simulation();
+  /**Check if the simulation preorder of an automaton is the identity,
+   * without computing it. This is the case when the automaton is
+   * co-deterministic and every state reaches its only final state, 
+   * because the words accepted from different states are then disjoint
+   * and there is at least one of them.
+   *@param aut The automaton
+   *@return true if no state simulates another state
+   */
+  static bool isIdentity(const class NonDetAut &aut);
+ private:
+  /**Copy constructor*/
+  Simulation(const class Simulation &old);
+  /**Assignment operator*/
+  class Simulation & operator=(const class Simulation &rhs);
+ public:
+  /**@return true iff state p simulates state q*/
+  bool simulates(unsigned p, unsigned q) const {
+    assert(p<mySize && q<mySize);
+    return myRows[q][p];
+  }
+  /**@return true iff states p and q simulate each other*/
+  bool equivalent(unsigned p, unsigned q) const {
+    return simulates(p, q) && simulates(q, p);
+  }
+  /**Compute the classes of states that simulate each other
+   *@param classes (output) the class of each state, numbered in the order
+   * of their smallest states
+   *@return the number of classes
+   */
+  unsigned classes(unsigned *classes) const;
+  /**Remove the states of a subset that are simulated by another state of
+   * the subset. Of equivalent states, the one with the smallest number
+   * is kept. The subset accepts the same words afterwards.
+   *@param subset The words of a bit vector with a bit for each state
+   */
+  void prune(word_t *subset) const {prune(subset, myDominated);}
+  /**Remove the simulated states of a subset, using the caller's work space
+   * so that several threads may prune at the same time
+   *@param subset The words of a bit vector with a bit for each state
+   *@param removed Work space for the states to be removed
+   */
+  void prune(word_t *subset, std::vector<unsigned> &removed) const;
+ private:
+  /**The number of states*/
+  unsigned mySize;
+  /**The states simulating each state*/
+  class BitVector *myRows;
+  /**The states found to be dominated by prune*/
+  mutable std::vector<unsigned> myDominated;
+};
+
+#endif //SIMULATION_H_
@@ -0,0 +1,123 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file StateStore.h
+ * Intern fixed-width subsets of states in an arena
+ */
+
+#ifndef STATESTORE_H_
+#define STATESTORE_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <climits>
+#include "BitVector.h"
+
+/**A set of bit vectors of the same width. The vectors are packed one after
+ * the other in an arena and numbered consecutively in the order of insertion.
+ * An open addressing hash table maps the contents to the numbers, and
+ * the hash value of each vector is kept for rehashing and for rejecting
+ * most mismatches without comparing the words. Vectors
+ * of one or two words are compared and hashed by code specialised
+ * for their width, chosen when the store is constructed.
+ */
+class StateStore {
+ public:
+  /**The machine word of the vectors*/
+  typedef BitVector::word_t word_t;
+  /**The number of bits in a word*/
+  static const unsigned wordBits=BitVector::wordBits;
+  /**Constructor of the class
+   *@param bits The width of the vectors in bits
+   */
+  explicit StateStore(unsigned bits);
+  /**The destructor*/
+  ~StateStore();
+ private:
+  /**Copy constructor*/
+  StateStore(const class StateStore &old);
+  /**Assignment operator*/
+  class StateStore & operator=(const class StateStore &rhs);
+ public:
+  /**Determine the width of vectors in words
+   *@param bits The width of the vectors in bits
+   */
+  static unsigned numWords(unsigned bits) {
+    return bits ? (bits + wordBits - 1) / wordBits : 1;
+  }
+  /**@return the width of the vectors in words*/
+  unsigned numWords() const {return myNumWords;}
+  /**@return the number of vectors*/
+  unsigned size() const {return mySize;}
+  /**Access a vector. The words may move when a vector is inserted.
+   *@param id The number of the vector
+   *@return the words of the vector
+   */
+  const word_t *operator[](unsigned id) const {
+    assert(id<mySize);
+    return myArena + id * myNumWords;
+  }
+  /**Look up a vector
+   *@param words The numWords() words of the vector
+   *@return the number of the vector, or UINT_MAX if it has not been inserted
+   */
+  unsigned find(const word_t *words) const;
+  /**Look up a vector, inserting it if it is new
+   *@param words The numWords() words of the vector, which are copied
+   *@param id (output) the number of the vector
+   *@return true iff the vector was inserted
+   */
+  bool insert(const word_t *words, unsigned &id);
+
+  /**Read a bit of a vector
+   *@param words The words of the vector
+   *@param index The number of the bit
+   */
+  static bool test(const word_t *words, unsigned index) {
+    return words[index / wordBits] & (word_t(1) << (index % wordBits));
+  }
+  /**Set a bit of a vector
+   *@param words The words of the vector
+   *@param index The number of the bit
+   */
+  static void set(word_t *words, unsigned index) {
+    words[index / wordBits] |= word_t(1) << (index % wordBits);
+  }
+ private:
+  /**Find the slot of a vector in the hash table
+   *@param words The words of the vector
+   *@param hash (output) the hash value of the vector
+   *@return the slot holding the number of the vector, or an empty slot
+   */
+  unsigned slot(const word_t *words, unsigned &hash) const {
+    return (this->*myProbe)(words, hash);
+  }
+  /**Find the slot of a vector of n words, or of numWords() words if n is 0
+   *@param words The words of the vector
+   *@param hash (output) the hash value of the vector
+   *@return the slot holding the number of the vector, or an empty slot
+   */
+  template<unsigned n> unsigned probe(const word_t *words, unsigned &hash) const;
+  /**Double the size of the hash table*/
+  void rehash();
+
+  /**The width of the vectors in words*/
+  unsigned myNumWords;
+  /**The number of vectors*/
+  unsigned mySize;
+  /**The number of vectors the arena can hold*/
+  unsigned myCapacity;
+  /**The vectors*/
+  word_t *myArena;
+  /**The hash values of the vectors*/
+  unsigned *myHashes;
+  /**The hash table of vector numbers, UINT_MAX for empty slots*/
+  unsigned *myTable;
+  /**The size of the hash table, a power of two*/
+  unsigned myTableSize;
+  /**The probe function specialised for the width of the vectors*/
+  unsigned (StateStore::*myProbe)(const word_t *words, unsigned &hash) const;
+};
+
+#endif //STATESTORE_H_
@@ -0,0 +1,108 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file SubsetStore.h
+ * Intern subsets of states in sparse or dense form
+ */
+
+#ifndef SUBSETSTORE_H_
+#define SUBSETSTORE_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <cassert>
+#include <climits>
+#include <vector>
+#include "BitVector.h"
+#include "MappedArray.h"
+
+/**A set of subsets of {0,...,n-1}, numbered consecutively in the order of
+ * insertion. Each subset is kept as a record: its cardinality followed 
+ * either by its elements in increasing order (sparse form) or by a bitmap
+ * (dense form), whichever is shorter. The form only depends on the
+ * cardinality, so equal subsets have equal records, and hashing and 
+ * comparing the records is consistent for both forms. The memory used thus
+ * grows with the total size of the subsets rather than with their number 
+ * times n. The records can be kept in memory-mapped files, leaving only
+ * the hash values and the hash table in memory.
+ */
+class SubsetStore {
+ public:
+  /**The machine word of the bit vectors*/
+  typedef BitVector::word_t word_t;
+  /**Constructor of the class
+   *@param size The number of possible elements n
+   *@param directory The directory of the files for the records, or 0 for
+   * keeping them in memory
+   */
+  explicit SubsetStore(unsigned size, const char *directory=0);
+  /**The destructor*/
+  ~SubsetStore();
+ private:
+  /**Copy constructor*/
+  SubsetStore(const class SubsetStore &old);
+  /**Assignment operator*/
+  class SubsetStore & operator=(const class SubsetStore &rhs);
+ public:
+  /**@return the number of subsets*/
+  unsigned size() const {return unsigned(myOffsets.size());}
+  /**Look up a subset, inserting it if it is new
+   *@param words The subset as a bit vector of n bits
+   *@param id (output) the number of the subset
+   *@return true iff the subset was inserted
+   */
+  bool insert(const word_t *words, unsigned &id);
+  /**Encode a subset as a record, computing its hash value. Several 
+   * threads may encode subsets at the same time.
+   *@param words The subset as a bit vector of n bits
+   *@param record (output) the vector the record is appended to
+   *@return the hash value of the record
+   */
+  unsigned encode(const word_t *words, std::vector<unsigned> &record) const;
+  /**Look up an encoded subset, inserting it if it is new
+   *@param record The record, as appended by encode
+   *@param hash The hash value, as returned by encode
+   *@param id (output) the number of the subset
+   *@return true iff the subset was inserted
+   */
+  bool insert(const unsigned *record, unsigned hash, unsigned &id);
+  /**Extract the elements of a subset
+   *@param id The number of the subset
+   *@param elements (output) the elements in increasing order
+   */
+  void elements(unsigned id, std::vector<unsigned> &elements) const;
+ private:
+  /**The bits of a record word*/
+  static const unsigned chunkBits=CHAR_BIT * sizeof(unsigned);
+  /**@return the number of words in a record*/
+  unsigned length(const unsigned *record) const {
+    return 1 + (*record < myDenseLength ? *record : myDenseLength);
+  }
+  /**Find the slot of a record
+   *@param record The record
+   *@param hash The hash value of the record
+   *@return the slot holding the number of the subset, or an empty slot
+   */
+  unsigned slot(const unsigned *record, unsigned hash) const;
+  /**Double the size of the hash table*/
+  void rehash();
+
+  /**The number of possible elements*/
+  unsigned myNumElements;
+  /**The length of the dense form in record words*/
+  unsigned myDenseLength;
+  /**The records of the subsets*/
+  class MappedArray<unsigned> myRecords;
+  /**The offset of the record of each subset*/
+  class MappedArray<size_t> myOffsets;
+  /**The hash value of each subset*/
+  std::vector<unsigned> myHashes;
+  /**Work space for encoding a record*/
+  std::vector<unsigned> myRecord;
+  /**The hash table of subset numbers, UINT_MAX for empty slots*/
+  unsigned *myTable;
+  /**The size of the hash table, a power of two*/
+  unsigned myTableSize;
+};
+
+#endif //SUBSETSTORE_H_
@@ -0,0 +1,85 @@
+// This file is part of scheck. See the file COPYING for details
+
+/** @file Symbolic.h
+ * Construct a deterministic automaton symbolically with BDDs
+ */
+
+#ifndef SYMBOLIC_H_
+#define SYMBOLIC_H_
+#ifdef __GNUC__
+#pragma interface
+#endif // __GNUC__
+
+#include <vector>
+#include "Bdd.h"
+
+class Formula;
+class Program;
+class DetAut;
+
+/**Construct a deterministic finite automaton for a formula without
+ * enumerating the states of the nondeterministic one. The states of 
+ * NonDetAut::create are encoded over one variable per rcl subformula, 
+ * and the rules of the subformulas are functions of the rcl subformulas
+ * at the next position and of the atomic propositions. The reachable 
+ * states are computed by image computation, and each subset of the 
+ * subset construction is a BDD, whose successors are found by 
+ * substituting the rules into it. The subsets are the same as those of 
+ * NonDetAut::determinize.
+ */
+class Symbolic {
+ public:
+  /**Constructor of the class
+   *@param f The formula, in negation normal form
+   */
+  explicit Symbolic(const class Formula &f);
+  /**The destructor*/
+  ~Symbolic();
+ private:
+  /**Copy constructor*/
+  Symbolic(const class Symbolic &old);
+  /**Assignment operator*/
+  class Symbolic & operator=(const class Symbolic &rhs);
+ public:
+  /**Construct the automaton
+   *@param result Place holder for the result
+   *@param budget the limits of the construction, or 0
+   *@return false if the budget was exceeded and result is incomplete
+   */
+  bool build(class DetAut &result, class Budget *budget=0);
+ private:
+  /**@return The variable of rcl subformula i at the current position*/
+  unsigned current(unsigned i) const {return myNumAP + 2 * i;}
+  /**@return The variable of rcl subformula i at the next position*/
+  unsigned next(unsigned i) const {return myNumAP + 2 * i + 1;}
+  /**Compute the states reachable from the state where nothing holds*/
+  void reach();
+  /**Compute the successors of a subset for every letter
+   *@param f The image of the subset, over the next position and the aps
+   *@param k The number of the next ap to fix
+   *@param letter The values of the aps fixed so far
+   *@param succs (output) the successor for each letter
+   */
+  void split(Bdd::Node f, unsigned k, unsigned letter, Bdd::Node *succs);
+  /**The subsets explored by build*/
+  class Rows;
+
+  /**The rules of the rcl subformulas*/
+  class Program *myProgram;
+  /**The number of atomic propositions*/
+  unsigned myNumAP;
+  /**The BDD package*/
+  class Bdd myBdd;
+  /**The function substituted for each variable when taking an image*/
+  std::vector<Bdd::Node> myRules;
+  /**Map from next to current variables*/
+  std::vector<unsigned> myShift;
+  /**Map from current to next variables*/
+  std::vector<unsigned> myUnshift;
+  /**The states where the formula holds at the current position*/
+  Bdd::Node myInitial;
+  /**The reachable states*/
+  Bdd::Node myReachable;
+};
+
+#endif //SYMBOLIC_H_
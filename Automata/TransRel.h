@@ -1,7 +1,7 @@
 // 2003 Timo Latvala (timo.latvala@hut.fi). See the file COPYING for details
 
 /** @TransRel.h
- * Define a transition relation using the stl multimap
+ * Define a transition relation with guarded arcs using the stl multimap
  */
 
 #ifndef TRANSREL_H_
@@ -11,67 +11,34 @@
 #else 
 #include <map>
 #endif //SGI_HASH_MAP
+#include "Implicant.h"
 
-class UIPair {
+/**An arc of the transition relation. The arc is enabled by every letter 
+ * covered by its guard. 
+ */
+class GuardArc {
  public:
-  explicit UIPair(unsigned s=0, unsigned l=0) : state(s), letter(l) {;}
-  UIPair(const class UIPair &old) : state(old.state), letter(old.letter) {;}
-  class UIPair & operator=(const class UIPair &rhs) {
+  /**Constructor of the class
+   * @param g The guard of the arc
+   * @param d The destination state
+   */
+  explicit GuardArc(const class Implicant &g, unsigned d) : guard(g), dest(d) {;}
+  GuardArc(const class GuardArc &old) : guard(old.guard), dest(old.dest) {;}
+  class GuardArc & operator=(const class GuardArc &rhs) {
     if (&rhs == this) return *this;
-    state=rhs.state;
-    letter=rhs.letter;
+    guard=rhs.guard;
+    dest=rhs.dest;
     return *this;
   }
-  bool operator==(const class UIPair &rhs) const {
-    return (state==rhs.state && letter == rhs.letter);
-  }
-  bool operator<(const class UIPair &rhs) const {
-    if(rhs.state > state) 
-      return true;
-    if(rhs.state < state)
-      return false;
-    return (letter < rhs.letter);
-  }
-  unsigned state; 
-  unsigned letter;
-#ifdef SGI_HASH_MAP
-  unsigned operator () (const class UIPair &p) const {
-    return hasher(p.state)^hasher(p.letter);
-  }
- private:
-  /** Integer hash function by Robert Jenkins (bob_jenkins@compuserve.com)
-   * <URL:http://ourworld.compuserve.com/homepages/bob_jenkins/blockcip.htm>
-   * @param key       key to be hashed
-   * @return          hash value of key
-   */
-  unsigned hasher (unsigned key) const {
-    key += key << 12;
-    key ^= key >> 22;
-    key += key << 4;
-    key ^= key >> 9;
-    key += key << 10;
-    key ^= key >> 2;
-    key += key << 7;
-    key ^= key >> 12;
-    return key;
-  }
-#endif //SGI_HASH_MAP
+  class Implicant guard;
+  unsigned dest;
 };
 
-
-#ifndef SGI_HASH_MAP 
-struct lt {
-  bool operator()(const class UIPair &p1, const class UIPair &p2) const {
-    return (p1 < p2);
-  }
-};
-#endif //SGI_HASH_MAP
-
-
+/**Map from a source state to its guarded arcs*/
 #ifdef SGI_HASH_MAP
-typedef Sgi::hash_multimap<class UIPair, unsigned, class UIPair> TransRel;
+typedef Sgi::hash_multimap<unsigned, class GuardArc> TransRel;
 #else
-typedef std::multimap<class UIPair, unsigned, lt> TransRel;
+typedef std::multimap<unsigned, class GuardArc> TransRel;
 #endif //SGI_HASH_MAP
 
 #endif //TRANSREL_H_
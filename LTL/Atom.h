@@ -50,7 +50,7 @@ class Atom : public Formula {
    */
   bool eval(const NumberMap & apmap, unsigned ap) const {
     assert(apmap.find(myId)!=apmap.end());
-    unsigned mask= 1<< (*apmap.find(myId)).second;
+    unsigned mask= 1u << (*apmap.find(myId)).second;
     return ((mask & ap) > 0);
   }
   
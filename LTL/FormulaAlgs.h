@@ -5,6 +5,7 @@
  */
 #ifndef FORMULAALGS_H_
 #define FORMULAALGS_H_
+#include <vector>
 /**Check if a formula is a syntactic safety formula*/
 bool 
 isSyntacticSafe(const class Formula &f);
@@ -33,4 +34,13 @@ parseFormula(FILE *inputFile);
  */
 class Formula *
 rewriteFormula(const class Formula *f);
+/**Split the top-level conjunction of a formula into components that 
+ * share no atomic propositions
+ * @param f formula to be split
+ * @param components (output) the conjuncts of each component, in the
+ * order they occur in f
+ */
+void
+splitConjunction(const class Formula &f, 
+		 std::vector<std::vector<const class Formula *> > &components);
 #endif //FORMULAALGS_H_